@@ -1,7 +1,9 @@
 #!/usr/bin/python3
 
 import sys
+from pathlib import Path
 from typing import Callable
+import numpy as np
 import pandas as pd
 import matplotlib.pyplot as plt
 
@@ -45,6 +47,17 @@ def dataframe_from_logs(file: str) -> pd.DataFrame:
     df = pd.DataFrame(data, columns=[var.name for var in RUNTIME_VARIABLES])
     return df
 
+def dataframe_from_regulator_log(file: str) -> pd.DataFrame:
+    """Load a file written by the regulatorLog function object"""
+    path = Path(file)
+
+    if path.suffix == ".csv":
+        return pd.read_csv(path)
+
+    columns = path.with_suffix(".columns").read_text().split()
+    data = np.memmap(path, dtype=np.float64, mode="r").reshape(-1, len(columns))
+    return pd.DataFrame(data, columns=columns)
+
 def plot_results(df: pd.DataFrame) -> None:
     t = df["time"]
 
@@ -75,7 +88,10 @@ def plot_results(df: pd.DataFrame) -> None:
 # ======================================================
 log_file = sys.argv[1]
 
-df = dataframe_from_logs(log_file)
+if Path(log_file).suffix in (".bin", ".csv"):
+    df = dataframe_from_regulator_log(log_file)
+else:
+    df = dataframe_from_logs(log_file)
 
 try:
     # write csv if out file is specified